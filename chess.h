@@ -12,6 +12,11 @@
 enum Piece { KING, QUEEN, BISHOP, KNIGHT, ROOK, PAWN, EMPTY };
 enum Color { WHITE, BLACK, NONE };
 
+struct Move {
+    int fromX, fromY, toX, toY;
+    Piece promotion;
+};
+
 class Square {
     Piece piece;
     Color color;
@@ -51,6 +56,8 @@ public:
 };
 
 class Board {
+    friend struct BoardProbe;
+
     Square board[8][8];
     Color turn = WHITE;
     std::pair<int, int> enPassantTarget = {-1, -1};
@@ -85,6 +92,16 @@ class Board {
         for (int i = 0; i < 8; ++i) {
             for (int j = 0; j < 8; ++j) {
                 if (board[i][j].getColor() == attackerColor) {
+                    // Pawns attack diagonally whether or not the square is occupied,
+                    // and never attack the square they could push to.
+                    if (board[i][j].getPiece() == PAWN) {
+                        int direction = (attackerColor == WHITE) ? -1 : 1;
+                        if (x == i + direction && abs(y - j) == 1) {
+                            turn = originalTurn;
+                            return true;
+                        }
+                        continue;
+                    }
                     if (isValidMoveInternal(i, j, x, y, false)) {
                         turn = originalTurn;
                         return true;
@@ -146,7 +163,7 @@ class Board {
                 if (dx_abs <= 1 && dy_abs <= 1) {
                     basicMoveValid = true;
                 }
-                else if (dx_abs == 0 && dy_abs == 2 && !from->getHasMoved()) {
+                else if (checkCheckConstraints && dx_abs == 0 && dy_abs == 2 && !from->getHasMoved()) {
                     basicMoveValid = isValidCastling(fromX, fromY, toX, toY, checkCheckConstraints);
                 }
                 break;
@@ -463,6 +480,171 @@ public:
         enPassantTarget = {-1, -1};
     }
 
+    // Sets up a position from a FEN string. The castling and en passant fields
+    // are optional and the move counters are ignored. Returns false (leaving the
+    // board partially set) if the placement does not describe 8 ranks of 8 files
+    // with exactly one king per side, or if any field present is malformed.
+    bool loadFEN(const std::string& fen) {
+        for (int i = 0; i < 8; ++i) {
+            for (int j = 0; j < 8; ++j) {
+                board[i][j].setX(i);
+                board[i][j].setY(j);
+                board[i][j].setEmpty();
+            }
+        }
+
+        size_t pos = 0;
+        int x = 0, y = 0;
+        int whiteKings = 0, blackKings = 0;
+        for (; pos < fen.size() && fen[pos] != ' '; ++pos) {
+            char c = fen[pos];
+            if (c == '/') {
+                if (y != 8 || ++x > 7) return false;
+                y = 0;
+                continue;
+            }
+            if (c >= '1' && c <= '8') {
+                y += c - '0';
+                if (y > 8) return false;
+                continue;
+            }
+            if (y > 7) return false;
+
+            Piece p;
+            switch (toupper(c)) {
+                case 'K': p = KING; break;
+                case 'Q': p = QUEEN; break;
+                case 'B': p = BISHOP; break;
+                case 'N': p = KNIGHT; break;
+                case 'R': p = ROOK; break;
+                case 'P': p = PAWN; break;
+                default: return false;
+            }
+            Color color = isupper(c) ? WHITE : BLACK;
+            if (p == KING) {
+                ++(color == WHITE ? whiteKings : blackKings);
+            }
+            // Kings and rooks start as "moved"; the castling field below re-enables them.
+            bool moved = (p == KING || p == ROOK);
+            board[x][y].setPieceAndColor(p, color, moved);
+            ++y;
+        }
+        if (x != 7 || y != 8) return false;
+        if (whiteKings != 1 || blackKings != 1) return false;
+
+        if (++pos >= fen.size()) return false;
+        if (fen[pos] == 'w') {
+            turn = WHITE;
+        } else if (fen[pos] == 'b') {
+            turn = BLACK;
+        } else {
+            return false;
+        }
+        if (++pos < fen.size() && fen[pos] != ' ') return false;
+
+        enPassantTarget = {-1, -1};
+        if (++pos >= fen.size()) return true;
+
+        if (fen[pos] == '-') {
+            ++pos;
+        } else {
+            for (; pos < fen.size() && fen[pos] != ' '; ++pos) {
+                Color color = isupper(fen[pos]) ? WHITE : BLACK;
+                int row = (color == WHITE) ? 7 : 0;
+                int rookY;
+                switch (toupper(fen[pos])) {
+                    case 'K': rookY = 7; break;
+                    case 'Q': rookY = 0; break;
+                    default: return false;
+                }
+                Square* king = &board[row][4];
+                Square* rook = &board[row][rookY];
+                if (king->getPiece() != KING || king->getColor() != color ||
+                    rook->getPiece() != ROOK || rook->getColor() != color) {
+                    return false;
+                }
+                king->setHasMoved(false);
+                rook->setHasMoved(false);
+            }
+        }
+        if (pos < fen.size() && fen[pos] != ' ') return false;
+
+        if (++pos >= fen.size()) return true;
+
+        if (fen[pos] == '-') {
+            ++pos;
+        } else {
+            if (pos + 1 >= fen.size()) return false;
+            char file = fen[pos], rank = fen[pos + 1];
+            if (file < 'a' || file > 'h') return false;
+            if (rank != (turn == WHITE ? '6' : '3')) return false;
+            enPassantTarget = {8 - (rank - '0'), file - 'a'};
+            pos += 2;
+        }
+        if (pos < fen.size() && fen[pos] != ' ') return false;
+
+        return true;
+    }
+
+    // Appends every legal move for the side to move. Promotions are expanded
+    // into one move per promotion piece.
+    void generateMoves(std::vector<Move>& moves) {
+        for (int fromX = 0; fromX < 8; ++fromX) {
+            for (int fromY = 0; fromY < 8; ++fromY) {
+                if (board[fromX][fromY].getColor() != turn) continue;
+                bool isPawn = board[fromX][fromY].getPiece() == PAWN;
+
+                for (int toX = 0; toX < 8; ++toX) {
+                    for (int toY = 0; toY < 8; ++toY) {
+                        if (!isValidMoveInternal(fromX, fromY, toX, toY, true)) continue;
+
+                        if (isPawn && (toX == 0 || toX == 7)) {
+                            moves.push_back({fromX, fromY, toX, toY, QUEEN});
+                            moves.push_back({fromX, fromY, toX, toY, ROOK});
+                            moves.push_back({fromX, fromY, toX, toY, BISHOP});
+                            moves.push_back({fromX, fromY, toX, toY, KNIGHT});
+                        } else {
+                            moves.push_back({fromX, fromY, toX, toY, EMPTY});
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Material balance in centipawns from the side to move's point of view.
+    int evaluate() const {
+        static const int values[] = {0, 900, 330, 320, 500, 100, 0};
+        int score = 0;
+        for (int x = 0; x < 8; ++x) {
+            for (int y = 0; y < 8; ++y) {
+                Color c = board[x][y].getColor();
+                if (c == NONE) continue;
+                int v = values[board[x][y].getPiece()];
+                score += (c == turn) ? v : -v;
+            }
+        }
+        return score;
+    }
+
+    // Counts leaf nodes of the full legal move tree to the given depth.
+    unsigned long long perft(int depth) {
+        if (depth == 0) return 1;
+
+        std::vector<Move> moves;
+        generateMoves(moves);
+        if (depth == 1) return moves.size();
+
+        unsigned long long nodes = 0;
+        for (const Move& m : moves) {
+            Board saved = *this;
+            applyMove(m);
+            nodes += perft(depth - 1);
+            *this = saved;
+        }
+        return nodes;
+    }
+
     void printBoard() const {
         std::cout << "\n    a  b  c  d  e  f  g  h \n";
         std::cout << "  +------------------------+\n";
@@ -498,13 +680,10 @@ public:
         std::cout << (turn == WHITE ? "White" : "Black") << " to move." << std::endl;
     }
 
-    bool makeMove(int fromX, int fromY, int toX, int toY) {
-
-        if (!isValidMoveInternal(fromX, fromY, toX, toY, true)) {
-            std::cout << "--- ILLEGAL MOVE --- Please try again." << std::endl;
-            return false;
-        }
-
+    // Applies an already validated move without any console interaction.
+    // A pawn reaching the last rank becomes m.promotion unless it is EMPTY.
+    void applyMove(const Move& m) {
+        int fromX = m.fromX, fromY = m.fromY, toX = m.toX, toY = m.toY;
         Square* from = &board[fromX][fromY];
         Square* to = &board[toX][toY];
         Piece movingPiece = from->getPiece();
@@ -550,11 +729,26 @@ public:
             enPassantTarget = {enPassantRow, toY};
         }
 
-        if (movingPiece == PAWN && (toX == 0 || toX == 7)) {
-            promotePawn(toX, toY);
+        if (movingPiece == PAWN && (toX == 0 || toX == 7) && m.promotion != EMPTY) {
+            board[toX][toY].setPieceAndColor(m.promotion, movingColor, true);
         }
 
         turn = opposite(turn);
+    }
+
+    bool makeMove(int fromX, int fromY, int toX, int toY) {
+
+        if (!isValidMoveInternal(fromX, fromY, toX, toY, true)) {
+            std::cout << "--- ILLEGAL MOVE --- Please try again." << std::endl;
+            return false;
+        }
+
+        bool promoting = board[fromX][fromY].getPiece() == PAWN && (toX == 0 || toX == 7);
+        applyMove({fromX, fromY, toX, toY, EMPTY});
+
+        if (promoting) {
+            promotePawn(toX, toY);
+        }
 
         if (isInCheck(turn)) {
             if (isCheckmate(turn)) {
@@ -1,11 +1,65 @@
 #include <iostream>
 #include <string>
 #include <limits>
+#include <chrono>
+#include <cstdlib>
 #include "chess.h"
 
 using namespace std;
 
-int main() {
+// Fixed positions searched by "chess bench". Changing this list or the default
+// depth changes the node signature, so treat both as part of the benchmark.
+static const char* const benchPositions[] = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+    "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+    "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+};
+
+static const int defaultBenchDepth = 4;
+
+static int runBench(int depth) {
+    unsigned long long totalNodes = 0;
+    auto start = chrono::steady_clock::now();
+
+    int index = 1;
+    for (const char* fen : benchPositions) {
+        Board b;
+        if (!b.loadFEN(fen)) {
+            cerr << "Invalid bench position: " << fen << endl;
+            return 1;
+        }
+        unsigned long long nodes = b.perft(depth);
+        cout << "Position " << index++ << ": " << nodes << endl;
+        totalNodes += nodes;
+    }
+
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    double seconds = elapsed.count();
+
+    cout << "===========================" << endl;
+    cout << "Total time (ms) : " << static_cast<long long>(seconds * 1000) << endl;
+    cout << "Nodes searched  : " << totalNodes << endl;
+    if (seconds > 0) {
+        cout << "Nodes/second    : " << static_cast<unsigned long long>(totalNodes / seconds) << endl;
+    } else {
+        cout << "Nodes/second    : n/a" << endl;
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && string(argv[1]) == "bench") {
+        int depth = (argc > 2) ? atoi(argv[2]) : defaultBenchDepth;
+        if (depth < 1) {
+            cerr << "Usage: " << argv[0] << " bench [depth]" << endl;
+            return 1;
+        }
+        return runBench(depth);
+    }
+
     Board b;
     string s;
     bool newgame = true;
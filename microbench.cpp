@@ -0,0 +1,142 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdlib>
+#include "chess.h"
+
+using namespace std;
+
+// Gives the benchmarks access to Board's private move-validation helpers.
+struct BoardProbe {
+    static bool isSquareUnderAttack(Board& b, int x, int y, Color attacker) {
+        return b.isSquareUnderAttack(x, y, attacker);
+    }
+    static bool isInCheck(Board& b, Color c) {
+        return b.isInCheck(c);
+    }
+    static bool isValidMoveInternal(Board& b, int fromX, int fromY, int toX, int toY) {
+        return b.isValidMoveInternal(fromX, fromY, toX, toY, true);
+    }
+};
+
+static const char* const positions[] = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+};
+
+static const int numPositions = sizeof(positions) / sizeof(positions[0]);
+
+// Keeps results observable so the timed loops are not optimized away.
+static volatile unsigned long long sink;
+
+// Prints one CSV row: benchmark,calls,total_ns,ns_per_call
+static void report(const string& name, unsigned long long calls, long long ns) {
+    cout << name << ',' << calls << ',' << ns << ',' << (calls ? ns / (long long)calls : 0) << endl;
+}
+
+// Runs op once per position per iteration. op returns how many times it
+// called the function being measured, so every row is reported per call.
+template <typename Op>
+static void runBenchmark(const string& name, int iterations, vector<Board>& boards, Op op) {
+    unsigned long long acc = 0;
+    unsigned long long calls = 0;
+    auto start = chrono::steady_clock::now();
+
+    for (int i = 0; i < iterations; ++i) {
+        for (Board& b : boards) {
+            calls += op(b, acc);
+        }
+    }
+
+    auto ns = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+    sink = acc;
+    report(name, calls, ns);
+}
+
+int main(int argc, char* argv[]) {
+    int scale = (argc > 1) ? atoi(argv[1]) : 1;
+    if (scale < 1) {
+        cerr << "Usage: " << argv[0] << " [iteration-scale]" << endl;
+        return 1;
+    }
+
+    vector<Board> boards(numPositions);
+    vector<vector<Move>> rootMoves(numPositions);
+    for (int i = 0; i < numPositions; ++i) {
+        if (!boards[i].loadFEN(positions[i])) {
+            cerr << "Invalid position: " << positions[i] << endl;
+            return 1;
+        }
+        boards[i].generateMoves(rootMoves[i]);
+    }
+
+    cout << "benchmark,calls,total_ns,ns_per_call" << endl;
+
+    runBenchmark("isSquareUnderAttack", 20000 * scale, boards, [](Board& b, unsigned long long& acc) {
+        for (int x = 0; x < 8; ++x) {
+            for (int y = 0; y < 8; ++y) {
+                acc += BoardProbe::isSquareUnderAttack(b, x, y, BLACK);
+            }
+        }
+        return 64;
+    });
+
+    runBenchmark("isInCheck", 200000 * scale, boards, [](Board& b, unsigned long long& acc) {
+        acc += BoardProbe::isInCheck(b, WHITE) + BoardProbe::isInCheck(b, BLACK);
+        return 2;
+    });
+
+    runBenchmark("isValidMoveInternal", 5000 * scale, boards, [](Board& b, unsigned long long& acc) {
+        for (int from = 0; from < 64; ++from) {
+            for (int to = 0; to < 64; ++to) {
+                acc += BoardProbe::isValidMoveInternal(b, from / 8, from % 8, to / 8, to % 8);
+            }
+        }
+        return 64 * 64;
+    });
+
+    runBenchmark("generateMoves", 2000 * scale, boards, [](Board& b, unsigned long long& acc) {
+        vector<Move> moves;
+        b.generateMoves(moves);
+        acc += moves.size();
+        return 1;
+    });
+
+    // Each root move is applied to its own prepared copy of the position, and
+    // the copies are refreshed outside the timed region between batches.
+    vector<Board> originals;
+    vector<Move> batchMoves;
+    for (int i = 0; i < numPositions; ++i) {
+        for (const Move& m : rootMoves[i]) {
+            originals.push_back(boards[i]);
+            batchMoves.push_back(m);
+        }
+    }
+
+    vector<Board> scratch = originals;
+    unsigned long long applyCalls = 0;
+    long long applyNs = 0;
+    for (int i = 0; i < 5000 * scale; ++i) {
+        for (size_t k = 0; k < scratch.size(); ++k) {
+            scratch[k] = originals[k];
+        }
+
+        auto start = chrono::steady_clock::now();
+        for (size_t k = 0; k < scratch.size(); ++k) {
+            scratch[k].applyMove(batchMoves[k]);
+        }
+        applyNs += chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+        applyCalls += scratch.size();
+    }
+    sink = scratch.back().evaluate();
+    report("applyMove", applyCalls, applyNs);
+
+    runBenchmark("evaluate", 2000000 * scale, boards, [](Board& b, unsigned long long& acc) {
+        acc += b.evaluate();
+        return 1;
+    });
+
+    return 0;
+}